@@ -0,0 +1,22 @@
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+// Outcome of a deadline-bounded run; digits are always a contiguous prefix
+typedef struct {
+    const char* backend;        // "bbp-serial" or "bbp-parallel"
+    int threads;
+    int digit_count;
+    double elapsed;             // Seconds, calibration included
+    double digits_per_second;
+} DeadlineReport;
+
+// Parse "200ms", "10s", "1.5s", "500us", "2m" (bare numbers are seconds);
+// rejects non-finite, non-positive and over-one-day budgets
+int deadline_parse(const char* text, double* seconds);
+
+// Compute digits 0, 1, 2, ... until the budget runs out (or max_digits,
+// when positive). Returns the malloc'd digits, or NULL on failure.
+int* deadline_compute_digits(int (*compute_digit)(long n), double budget, int max_digits,
+                             DeadlineReport* report);
+
+#endif
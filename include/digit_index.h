@@ -0,0 +1,34 @@
+#ifndef DIGIT_INDEX_H
+#define DIGIT_INDEX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Memory-mapped k-mer index over a packed decimal digit store. One file
+// holds the packed digits (two per byte), the bucket table for every
+// k-digit sequence, and the digit offsets grouped by bucket.
+typedef struct {
+    const unsigned char* packed;    // Digit i in nibble i & 1 of byte i / 2
+    const uint64_t* buckets;        // 10^k + 1 bucket starts into positions
+    const uint32_t* positions;      // Offsets sorted by k-mer, then offset
+    uint64_t digit_count;
+    uint64_t source_digits;         // Hex digits the decimals came from
+    int k;
+
+    void* map;
+    size_t map_size;
+} DigitIndex;
+
+// Builder: digits are ASCII '0'-'9'; returns 0 on success, -1 on failure
+int digit_index_build(const char* path, const char* digits, uint64_t digit_count,
+                      uint64_t source_digits);
+
+// Constructor/Destructor
+DigitIndex* digit_index_open(const char* path);
+void digit_index_close(DigitIndex* index);
+
+// Query: every 0-based offset where pattern starts, ascending. Returns the
+// match count (the caller frees *offsets) or -1 for a non-digit pattern.
+long digit_index_find(const DigitIndex* index, const char* pattern, uint64_t** offsets);
+
+#endif
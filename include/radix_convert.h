@@ -0,0 +1,17 @@
+#ifndef RADIX_CONVERT_H
+#define RADIX_CONVERT_H
+
+// Converts a hexadecimal fraction 0.h1h2h3... (the BBP digit stream) into
+// decimal fraction digits using divide-and-conquer base conversion.
+typedef struct {
+    char* digits;       // ASCII decimal digits, NUL-terminated
+    long digit_count;   // Digits produced: floor(hex_count * log10(16))
+    long valid_count;   // Leading digits fixed by the hex input alone
+    int threads;        // Worker threads used for the conversion
+} RadixConversion;
+
+// Constructor/Destructor
+RadixConversion* radix_convert_hex_to_decimal(const int* hex_digits, long hex_count);
+void radix_conversion_destroy(RadixConversion* conversion);
+
+#endif
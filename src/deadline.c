@@ -0,0 +1,141 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "deadline.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define DEADLINE_MIN_DIGITS 9            // Legal and design outputs read digits 0..8
+#define DEADLINE_OUTPUT_RESERVE 0.05     // Budget share kept for producing output
+#define DEADLINE_CALIBRATION_SHARE 0.02  // Budget share spent on the serial calibration
+#define DEADLINE_CHUNK_SHARE 0.25        // Remaining-budget share planned per chunk
+#define DEADLINE_PARALLEL_MIN 32         // Digits per thread before threads pay off
+#define DEADLINE_MAX_SECONDS 86400.0     // Longest accepted budget (one day)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// BBP digit n runs ~(n + 1)^2 modular steps; work(m) sums that over 0..m-1
+static double work(double m) {
+    return m * (m + 1.0) * (2.0 * m + 1.0) / 6.0;
+}
+
+// Largest digit count whose total work stays within w
+static double digits_for_work(double w) {
+    double m = cbrt(3.0 * w);
+    while (m > 0 && work(m) > w) m -= 1.0;
+    return m;
+}
+
+int deadline_parse(const char* text, double* seconds) {
+    // The number must start the text: strtod would skip leading whitespace
+    if (!((*text >= '0' && *text <= '9') || *text == '.')) return -1;
+
+    char* end;
+    double value = strtod(text, &end);
+    if (end == text || !isfinite(value) || !(value > 0)) return -1;
+
+    double scale;
+    if (*end == '\0' || strcmp(end, "s") == 0) scale = 1.0;
+    else if (strcmp(end, "ms") == 0) scale = 1e-3;
+    else if (strcmp(end, "us") == 0) scale = 1e-6;
+    else if (strcmp(end, "m") == 0) scale = 60.0;
+    else return -1;
+
+    value *= scale;
+    if (!(value > 0) || value > DEADLINE_MAX_SECONDS) return -1;
+    *seconds = value;
+    return 0;
+}
+
+int* deadline_compute_digits(int (*compute_digit)(long n), double budget, int max_digits,
+                             DeadlineReport* report) {
+    double start = now_seconds();
+    double stop = start + budget * (1.0 - DEADLINE_OUTPUT_RESERVE);
+    int limit = max_digits > 0 ? max_digits : INT_MAX;
+    if (limit < DEADLINE_MIN_DIGITS) limit = DEADLINE_MIN_DIGITS;
+
+    int capacity = 256;
+    int* digits = malloc(capacity * sizeof(int));
+    if (!digits) return NULL;
+
+    // Calibration: the mandatory digits, then serial digits until the
+    // calibration share is spent; they fit the per-step cost c
+    int count = 0;
+    double calibrate_until = start + budget * DEADLINE_CALIBRATION_SHARE;
+    while (count < limit && (count < DEADLINE_MIN_DIGITS || now_seconds() < calibrate_until)) {
+        if (count == capacity) {
+            int* grown = realloc(digits, 2 * (size_t)capacity * sizeof(int));
+            if (!grown) {
+                free(digits);
+                return NULL;
+            }
+            digits = grown;
+            capacity *= 2;
+        }
+        digits[count] = compute_digit(count);
+        count++;
+    }
+    double c = (now_seconds() - start) / work(count);
+    if (c <= 0) c = 1e-9;
+
+    // Backend: threads only when the predicted remainder keeps them all busy
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    double remaining = stop - now_seconds();
+    double target = remaining > 0 ? digits_for_work(work(count) + remaining * threads / c) : count;
+    if (target > limit) target = limit;
+    int spare = (int)(target - count) / DEADLINE_PARALLEL_MIN;
+    if (spare < threads) threads = spare > 1 ? spare : 1;
+
+    // Chunks sized to a share of the remaining budget; a digit only starts
+    // when its predicted cost fits, so work stops at a contiguous prefix
+    while (count < limit) {
+        double chunk_start = now_seconds();
+        remaining = stop - chunk_start;
+        if (remaining <= 0 || c * (double)(count + 1) * (count + 1) > remaining) break;
+
+        double end = digits_for_work(work(count) + remaining * DEADLINE_CHUNK_SHARE * threads / c);
+        int chunk_end = end > limit ? limit : (int)end;
+        if (chunk_end <= count) chunk_end = count + 1;
+
+        if (chunk_end > capacity) {
+            int grown_capacity = capacity;
+            while (grown_capacity < chunk_end) grown_capacity *= 2;
+            int* grown = realloc(digits, (size_t)grown_capacity * sizeof(int));
+            if (!grown) break;
+            digits = grown;
+            capacity = grown_capacity;
+        }
+
+        #pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+        for (int i = count; i < chunk_end; i++) {
+            double cost = c * (double)(i + 1) * (i + 1);
+            digits[i] = now_seconds() + cost <= stop ? compute_digit(i) : -1;
+        }
+
+        int first = count;
+        while (count < chunk_end && digits[count] >= 0) count++;
+        if (count > first) {
+            c = (now_seconds() - chunk_start) * threads / (work(count) - work(first));
+        }
+        if (count < chunk_end) break;
+    }
+
+    report->backend = threads > 1 ? "bbp-parallel" : "bbp-serial";
+    report->threads = threads;
+    report->digit_count = count;
+    report->elapsed = now_seconds() - start;
+    report->digits_per_second = report->elapsed > 0 ? count / report->elapsed : 0.0;
+    return digits;
+}
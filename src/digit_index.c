@@ -0,0 +1,253 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "digit_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define INDEX_MAGIC "PIDX0001"
+#define INDEX_MAX_K 7
+#define INDEX_HEADER_SIZE 64
+
+// On-disk header; sections follow at the recorded 8-byte aligned offsets
+typedef struct {
+    char magic[8];
+    uint64_t digit_count;
+    uint64_t source_digits;
+    uint64_t packed_offset;
+    uint64_t buckets_offset;
+    uint64_t positions_offset;
+    uint32_t k;
+    uint32_t reserved;
+} DigitIndexHeader;
+
+static uint64_t align8(uint64_t v) {
+    return (v + 7) & ~(uint64_t)7;
+}
+
+static uint64_t pow10_u64(int k) {
+    uint64_t p = 1;
+    while (k-- > 0) p *= 10;
+    return p;
+}
+
+// About 1000 offsets per bucket, capped so the bucket table stays small
+static int choose_k(uint64_t digit_count) {
+    int k = 0;
+    for (uint64_t v = digit_count; v >= 10; v /= 10) k++;
+    k -= 2;
+    if (k < 1) k = 1;
+    if (k > INDEX_MAX_K) k = INDEX_MAX_K;
+    return k;
+}
+
+static int packed_digit(const unsigned char* packed, uint64_t i) {
+    return (packed[i / 2] >> (4 * (i & 1))) & 0xF;
+}
+
+static int compare_offsets(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+// Builder
+int digit_index_build(const char* path, const char* digits, uint64_t digit_count,
+                      uint64_t source_digits) {
+    if (digit_count == 0 || digit_count > UINT32_MAX) return -1;
+    for (uint64_t i = 0; i < digit_count; i++) {
+        if (digits[i] < '0' || digits[i] > '9') return -1;
+    }
+
+    int k = choose_k(digit_count);
+    uint64_t bucket_count = pow10_u64(k);
+    uint64_t entries = digit_count - (uint64_t)k + 1;
+
+    DigitIndexHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+    header.digit_count = digit_count;
+    header.source_digits = source_digits;
+    header.k = (uint32_t)k;
+    header.packed_offset = INDEX_HEADER_SIZE;
+    header.buckets_offset = align8(header.packed_offset + (digit_count + 1) / 2);
+    header.positions_offset = header.buckets_offset + (bucket_count + 1) * sizeof(uint64_t);
+    uint64_t size = header.positions_offset + entries * sizeof(uint32_t);
+
+    // Write to a temporary file and rename, so readers never map a partial index
+    size_t path_len = strlen(path);
+    char* tmp_path = malloc(path_len + 5);
+    if (!tmp_path) return -1;
+    memcpy(tmp_path, path, path_len);
+    memcpy(tmp_path + path_len, ".tmp", 5);
+
+    int fd = open(tmp_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        free(tmp_path);
+        return -1;
+    }
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        unlink(tmp_path);
+        free(tmp_path);
+        return -1;
+    }
+    unsigned char* base = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        unlink(tmp_path);
+        free(tmp_path);
+        return -1;
+    }
+
+    memcpy(base, &header, sizeof(header));
+    unsigned char* packed = base + header.packed_offset;
+    uint64_t* buckets = (uint64_t*)(base + header.buckets_offset);
+    uint32_t* positions = (uint32_t*)(base + header.positions_offset);
+
+    for (uint64_t i = 0; i < digit_count; i++) {
+        packed[i / 2] |= (unsigned char)((digits[i] - '0') << (4 * (i & 1)));
+    }
+
+    // Counting sort by k-mer: count into buckets[code + 1], prefix-sum into
+    // starts, scatter using buckets[code] as the cursor, then shift back.
+    uint64_t code = 0;
+    for (int j = 0; j < k - 1; j++) code = code * 10 + (uint64_t)(digits[j] - '0');
+    for (uint64_t i = 0; i < entries; i++) {
+        code = (code * 10 + (uint64_t)(digits[i + k - 1] - '0')) % bucket_count;
+        buckets[code + 1]++;
+    }
+    for (uint64_t c = 1; c <= bucket_count; c++) buckets[c] += buckets[c - 1];
+
+    code = 0;
+    for (int j = 0; j < k - 1; j++) code = code * 10 + (uint64_t)(digits[j] - '0');
+    for (uint64_t i = 0; i < entries; i++) {
+        code = (code * 10 + (uint64_t)(digits[i + k - 1] - '0')) % bucket_count;
+        positions[buckets[code]++] = (uint32_t)i;
+    }
+    for (uint64_t c = bucket_count; c > 0; c--) buckets[c] = buckets[c - 1];
+    buckets[0] = 0;
+
+    int status = msync(base, (size_t)size, MS_SYNC);
+    munmap(base, (size_t)size);
+    if (status == 0) status = rename(tmp_path, path);
+    if (status != 0) unlink(tmp_path);
+    free(tmp_path);
+    return status == 0 ? 0 : -1;
+}
+
+// Constructor
+DigitIndex* digit_index_open(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < INDEX_HEADER_SIZE) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    unsigned char* base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+
+    // Every section must sit exactly where the builder puts it and fit in
+    // the file; anything else is truncated or foreign and gets rebuilt
+    DigitIndexHeader header;
+    memcpy(&header, base, sizeof(header));
+    int valid = memcmp(header.magic, INDEX_MAGIC, sizeof(header.magic)) == 0 &&
+                header.k >= 1 && header.k <= INDEX_MAX_K &&
+                header.digit_count >= header.k && header.digit_count <= UINT32_MAX;
+    uint64_t bucket_count = valid ? pow10_u64((int)header.k) : 0;
+    uint64_t entries = valid ? header.digit_count - header.k + 1 : 0;
+    valid = valid &&
+            header.packed_offset == INDEX_HEADER_SIZE &&
+            header.buckets_offset == align8(header.packed_offset + (header.digit_count + 1) / 2) &&
+            header.positions_offset == header.buckets_offset + (bucket_count + 1) * sizeof(uint64_t) &&
+            header.positions_offset + entries * sizeof(uint32_t) <= size &&
+            ((const uint64_t*)(base + header.buckets_offset))[bucket_count] == entries;
+    if (!valid) {
+        munmap(base, size);
+        return NULL;
+    }
+
+    DigitIndex* index = malloc(sizeof(DigitIndex));
+    if (!index) {
+        munmap(base, size);
+        return NULL;
+    }
+    index->packed = base + header.packed_offset;
+    index->buckets = (const uint64_t*)(base + header.buckets_offset);
+    index->positions = (const uint32_t*)(base + header.positions_offset);
+    index->digit_count = header.digit_count;
+    index->source_digits = header.source_digits;
+    index->k = (int)header.k;
+    index->map = base;
+    index->map_size = size;
+    return index;
+}
+
+// Destructor
+void digit_index_close(DigitIndex* index) {
+    if (index) {
+        munmap(index->map, index->map_size);
+        free(index);
+    }
+}
+
+// Patterns of at least k digits read one bucket and check the remaining
+// digits against the packed store. Shorter patterns cover a contiguous
+// bucket range, plus the last k - 1 offsets that start no full k-mer.
+long digit_index_find(const DigitIndex* index, const char* pattern, uint64_t** offsets) {
+    size_t len = strlen(pattern);
+    *offsets = NULL;
+    if (len == 0) return -1;
+    for (size_t i = 0; i < len; i++) {
+        if (pattern[i] < '0' || pattern[i] > '9') return -1;
+    }
+    if (len > index->digit_count) return 0;
+
+    int k = index->k;
+    size_t prefix = len < (size_t)k ? len : (size_t)k;
+    uint64_t code = 0;
+    for (size_t i = 0; i < prefix; i++) code = code * 10 + (uint64_t)(pattern[i] - '0');
+    uint64_t span = pow10_u64(k - (int)prefix);
+    uint64_t tail_start = index->digit_count - (uint64_t)k + 1;
+    uint64_t first = index->buckets[code * span];
+    uint64_t last = index->buckets[(code + 1) * span];
+    if (last > tail_start) last = tail_start;
+    if (first > last) first = last;
+    uint64_t tail_count = len < (size_t)k ? (uint64_t)k - 1 : 0;
+
+    uint64_t capacity = last - first + tail_count;
+    if (capacity == 0) return 0;
+    uint64_t* found = malloc(capacity * sizeof(uint64_t));
+    if (!found) return -1;
+
+    long count = 0;
+    for (uint64_t p = first; p < last; p++) {
+        uint64_t off = index->positions[p];
+        size_t i = prefix;
+        if (off + len > index->digit_count) continue;
+        while (i < len && packed_digit(index->packed, off + i) == pattern[i] - '0') i++;
+        if (i == len) found[count++] = off;
+    }
+    if (span > 1) qsort(found, (size_t)count, sizeof(uint64_t), compare_offsets);
+
+    for (uint64_t off = tail_start; tail_count && off + len <= index->digit_count; off++) {
+        size_t i = 0;
+        while (i < len && packed_digit(index->packed, off + i) == pattern[i] - '0') i++;
+        if (i == len) found[count++] = off;
+    }
+
+    if (count == 0) {
+        free(found);
+        return 0;
+    }
+    *offsets = found;
+    return count;
+}
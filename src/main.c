@@ -5,10 +5,14 @@
 #include <getopt.h>
 #include "infinity_matrix.h"
 #include "nsibidi_utils.h"
+#include "radix_convert.h"
+#include "digit_index.h"
+#include "deadline.h"
 
 #define BASE_VIOLATIONS 216
 #define VIOLATION_CYCLES_PER_YEAR 14.4
 #define DEFAULT_DIGITS 100
+#define DEFAULT_INDEX_PATH "pi_digits.idx"
 
 void print_banner() {
     printf("----- [OBINexus Pi] Infinite Accountability Forensic Tool -----\n");
@@ -20,8 +24,12 @@ void print_usage() {
     printf("Usage: obinexus_pi [OPTIONS]\n");
     printf("Options:\n");
     printf("  -n, --digits N      Compute first N digits of π (default: 100)\n");
+    printf("  -t, --deadline T    Compute as many digits as fit in T (200ms, 10s)\n");
     printf("  -l, --legal         Generate legal claim output\n");
     printf("  -d, --design        Generate Nsibidi design output\n");
+    printf("  -x, --decimal       Convert the hex digits to decimal π\n");
+    printf("  -f, --find SEQ      List positions of SEQ in decimal π\n");
+    printf("  -i, --index PATH    Digit index for --find (default: %s)\n", DEFAULT_INDEX_PATH);
     printf("  -h, --help          Show this help message\n");
 }
 
@@ -48,6 +56,22 @@ void generate_legal_output(int* pi_digits, int num_digits) {
     printf("**Magnitude:** %.2f | **Det(M):** %.2f | **Class:** U∞\n", magnitude, matrix_determinant_3x3(M));
     printf("**Claim:** £%d per cycle | **Total:** ∞\n", 10000);
 }
+
+void generate_decimal_output(int* pi_digits, int num_digits) {
+    RadixConversion* conversion = radix_convert_hex_to_decimal(pi_digits, num_digits);
+    if (!conversion) {
+        fprintf(stderr, "Radix conversion failed\n");
+        return;
+    }
+
+    printf("[*] Radix Conversion: %d hex digits -> %ld decimal digits (%d threads)\n",
+           num_digits, conversion->digit_count, conversion->threads);
+    printf("[+] Valid decimal prefix: %ld digits\n", conversion->valid_count);
+    printf("π = 3.%.*s\n", (int)conversion->valid_count, conversion->digits);
+
+    radix_conversion_destroy(conversion);
+}
+
 // BBP formula to compute nth hexadecimal digit of pi
 int get_pi_hex_digit(long n) {
     double s = 0.0;
@@ -95,6 +119,64 @@ int get_pi_hex_digit(long n) {
 }
 
 
+// Look SEQ up in the digit index, building it from n hex digits when it is
+// missing or (with an explicit -n) was built from fewer digits
+int run_digit_search(const char* pattern, const char* index_path, int num_digits, int digits_given) {
+    DigitIndex* index = digit_index_open(index_path);
+    if (index && digits_given && index->source_digits < (uint64_t)num_digits) {
+        digit_index_close(index);
+        index = NULL;
+    }
+
+    if (!index) {
+        printf("[*] Building Digit Index %s from %d hex digits...\n", index_path, num_digits);
+        int* pi_digits = malloc(num_digits * sizeof(int));
+        if (!pi_digits) {
+            fprintf(stderr, "Memory allocation failed\n");
+            return 1;
+        }
+        for (int i = 0; i < num_digits; i++) {
+            pi_digits[i] = get_pi_hex_digit(i);
+        }
+
+        RadixConversion* conversion = radix_convert_hex_to_decimal(pi_digits, num_digits);
+        free(pi_digits);
+        if (!conversion ||
+            digit_index_build(index_path, conversion->digits, conversion->valid_count, num_digits) != 0) {
+            fprintf(stderr, "Digit index build failed: %s\n", index_path);
+            radix_conversion_destroy(conversion);
+            return 1;
+        }
+        radix_conversion_destroy(conversion);
+
+        index = digit_index_open(index_path);
+        if (!index) {
+            fprintf(stderr, "Digit index open failed: %s\n", index_path);
+            return 1;
+        }
+    }
+
+    uint64_t* offsets;
+    long count = digit_index_find(index, pattern, &offsets);
+    if (count < 0) {
+        fprintf(stderr, "Invalid digit sequence: %s\n", pattern);
+        digit_index_close(index);
+        return 1;
+    }
+
+    // Positions count decimal places: position 1 is the 1 in 3.14159...
+    printf("[*] Digit Index: %s (%llu decimal digits, k=%d)\n",
+           index_path, (unsigned long long)index->digit_count, index->k);
+    printf("[+] Sequence %s: %ld occurrence(s)\n", pattern, count);
+    for (long i = 0; i < count; i++) {
+        printf("    position %llu\n", (unsigned long long)offsets[i] + 1);
+    }
+
+    free(offsets);
+    digit_index_close(index);
+    return 0;
+}
+
 /**
 
 void generate_legal_output_with_engine(PiEngine* engine, int num_digits) {
@@ -115,22 +197,38 @@ int main(int argc, char *argv[]) {
     int num_digits = DEFAULT_DIGITS;
     int legal_mode = 0;
     int design_mode = 0;
+    int decimal_mode = 0;
+    int digits_given = 0;
+    const char* find_pattern = NULL;
+    const char* index_path = DEFAULT_INDEX_PATH;
+    double deadline_seconds = 0.0;
 
     // Parse command line arguments
     static struct option long_options[] = {
         {"digits", required_argument, 0, 'n'},
+        {"deadline", required_argument, 0, 't'},
         {"legal", no_argument, 0, 'l'},
         {"design", no_argument, 0, 'd'},
+        {"decimal", no_argument, 0, 'x'},
+        {"find", required_argument, 0, 'f'},
+        {"index", required_argument, 0, 'i'},
         {"help", no_argument, 0, 'h'},
         {0, 0, 0, 0}
     };
 
     int opt;
-    while ((opt = getopt_long(argc, argv, "n:ldh", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "n:t:ldxf:i:h", long_options, NULL)) != -1) {
         switch (opt) {
             case 'n':
                 num_digits = atoi(optarg);
                 if (num_digits <= 0) num_digits = DEFAULT_DIGITS;
+                digits_given = 1;
+                break;
+            case 't':
+                if (deadline_parse(optarg, &deadline_seconds) != 0) {
+                    fprintf(stderr, "Invalid deadline: %s\n", optarg);
+                    return 1;
+                }
                 break;
             case 'l':
                 legal_mode = 1;
@@ -138,6 +236,15 @@ int main(int argc, char *argv[]) {
             case 'd':
                 design_mode = 1;
                 break;
+            case 'x':
+                decimal_mode = 1;
+                break;
+            case 'f':
+                find_pattern = optarg;
+                break;
+            case 'i':
+                index_path = optarg;
+                break;
             case 'h':
                 print_usage();
                 return 0;
@@ -147,12 +254,41 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    if (!legal_mode && !design_mode) {
+    if (find_pattern) {
+        // Reject bad sequences before any index is opened or built
+        if (find_pattern[0] == '\0' || strspn(find_pattern, "0123456789") != strlen(find_pattern)) {
+            fprintf(stderr, "Invalid digit sequence: %s\n", find_pattern);
+            return 1;
+        }
+        // Index builds run to completion; a budget here would be ignored
+        if (deadline_seconds > 0) {
+            fprintf(stderr, "--deadline cannot be combined with --find\n");
+            return 1;
+        }
+        return run_digit_search(find_pattern, index_path, num_digits, digits_given);
+    }
+
+    if (!legal_mode && !design_mode && !decimal_mode) {
         print_banner();
     }
 
-    // Allocate memory for π digits
-    int* pi_digits = malloc(num_digits * sizeof(int));
+    // Allocate memory for π digits, or let the deadline decide how many
+    // (-n then caps the count); the first 9 digits are always computed
+    int* pi_digits;
+    if (deadline_seconds > 0) {
+        DeadlineReport report;
+        pi_digits = deadline_compute_digits(get_pi_hex_digit, deadline_seconds,
+                                            digits_given ? num_digits : 0, &report);
+        if (pi_digits) {
+            num_digits = report.digit_count;
+            printf("[*] Deadline: %g ms | Backend: %s (%d threads)\n",
+                   deadline_seconds * 1e3, report.backend, report.threads);
+            printf("[+] Computed %d digits in %.1f ms (%.0f digits/s)\n",
+                   report.digit_count, report.elapsed * 1e3, report.digits_per_second);
+        }
+    } else {
+        pi_digits = malloc(num_digits * sizeof(int));
+    }
     if (!pi_digits) {
         fprintf(stderr, "Memory allocation failed\n");
         return 1;
@@ -166,9 +302,9 @@ int main(int argc, char *argv[]) {
     printf("[*] Computing π Violation Digits (n=0 to %d)...\n", num_digits-1);
 
     for (int i = 0; i < num_digits; i++) {
-    pi_digits[i] = get_pi_hex_digit(i);   // Use actual BBP
+    if (deadline_seconds <= 0) pi_digits[i] = get_pi_hex_digit(i);   // Use actual BBP
     int violation_type = pi_digits[i] % 3;
-    if (!legal_mode && !design_mode) {
+    if (!legal_mode && !design_mode && !decimal_mode) {
         printf("n=%d: digit=%x | violation_type=%d\n", i, pi_digits[i], violation_type);
     }
 }
@@ -185,6 +321,12 @@ int main(int argc, char *argv[]) {
         return 0;
     }
 
+    if (decimal_mode) {
+        generate_decimal_output(pi_digits, num_digits);
+        free(pi_digits);
+        return 0;
+    }
+
     // Calculate compound magnitude
     double housing_viol = pi_digits[0] * VIOLATION_CYCLES_PER_YEAR;
     double health_viol = pi_digits[1] * VIOLATION_CYCLES_PER_YEAR;
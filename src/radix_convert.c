@@ -0,0 +1,679 @@
+#include "radix_convert.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Multiplication thresholds (in 32-bit limbs)
+#define KARATSUBA_THRESHOLD 32
+#define NTT_THRESHOLD 768
+
+// Conversion tree: leaves hold LEAF_DIGITS * 2^i decimal digits
+#define LEAF_DIGITS 9
+#define LEAF_POWER 1000000000u
+#define BASECASE_DIGITS 288
+#define TASK_MIN_DIGITS 20000
+#define TASK_MIN_LIMBS 4096
+#define NTT_GRAIN 8192
+#define NTT_BLOCK_LOG 13
+
+// NTT primes: p1 * p2 bounds every 16-bit piece convolution up to 2^26 terms
+#define NTT_P1 2013265921u
+#define NTT_G1 31u
+#define NTT_P2 469762049u
+#define NTT_G2 3u
+#define NTT_MAX_LOG 26
+
+#define LOG10_16 1.2041199826559247808
+
+typedef struct {
+    uint32_t* limbs;
+    size_t len;
+} RadixNum;
+
+// Power table entry: P = 10^(LEAF_DIGITS * 2^i), R = floor(2^shift / P)
+typedef struct {
+    RadixNum power;
+    RadixNum reciprocal;
+    size_t shift;
+} RadixLevel;
+
+static void* radix_alloc(size_t count, size_t size) {
+    void* p = calloc(count ? count : 1, size);
+    if (!p) {
+        fprintf(stderr, "Memory allocation failed\n");
+        abort();
+    }
+    return p;
+}
+
+// ---- Limb arithmetic ----
+
+static size_t limbs_trim(const uint32_t* a, size_t n) {
+    while (n > 0 && a[n - 1] == 0) n--;
+    return n;
+}
+
+static int limbs_cmp(const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+    if (an != bn) return an < bn ? -1 : 1;
+    while (an-- > 0) {
+        if (a[an] != b[an]) return a[an] < b[an] ? -1 : 1;
+    }
+    return 0;
+}
+
+// r[0..an) = a + b, requires an >= bn; r may alias a. Returns the carry.
+static uint32_t limbs_add(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+    uint64_t carry = 0;
+    size_t i;
+    for (i = 0; i < bn; i++) {
+        carry += (uint64_t)a[i] + b[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    for (; i < an; i++) {
+        carry += a[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    return (uint32_t)carry;
+}
+
+// r[0..an) = a - b, requires a >= b; r may alias a.
+static void limbs_sub(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+    int64_t borrow = 0;
+    size_t i;
+    for (i = 0; i < bn; i++) {
+        int64_t t = (int64_t)a[i] - b[i] - borrow;
+        borrow = t < 0;
+        r[i] = (uint32_t)t;
+    }
+    for (; i < an; i++) {
+        int64_t t = (int64_t)a[i] - borrow;
+        borrow = t < 0;
+        r[i] = (uint32_t)t;
+    }
+}
+
+static void mul_limbs(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn);
+
+static void mul_schoolbook(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+    memset(r, 0, (an + bn) * sizeof(uint32_t));
+    for (size_t i = 0; i < an; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < bn; j++) {
+            carry += (uint64_t)a[i] * b[j] + r[i + j];
+            r[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        r[i + bn] = (uint32_t)carry;
+    }
+}
+
+// Karatsuba for bn > ceil(an / 2), split at h = ceil(an / 2)
+static void mul_karatsuba(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+    size_t h = (an + 1) / 2;
+    size_t a1n = an - h, b1n = bn - h;
+    uint32_t* sa = radix_alloc(h + 1, sizeof(uint32_t));
+    uint32_t* sb = radix_alloc(h + 1, sizeof(uint32_t));
+    uint32_t* z1 = radix_alloc(2 * h + 2, sizeof(uint32_t));
+
+    sa[h] = limbs_add(sa, a, h, a + h, a1n);
+    sb[h] = limbs_add(sb, b, h, b + h, b1n);
+
+    memset(r, 0, (an + bn) * sizeof(uint32_t));
+    #pragma omp task shared(r, a, b) if(an >= TASK_MIN_LIMBS)
+    mul_limbs(r, a, h, b, h);
+    #pragma omp task shared(r, a, b) if(an >= TASK_MIN_LIMBS)
+    mul_limbs(r + 2 * h, a + h, a1n, b + h, b1n);
+    mul_limbs(z1, sa, h + 1, sb, h + 1);
+    #pragma omp taskwait
+
+    // z1 -= z0 + z2, then r += z1 * B^h
+    size_t z1n = limbs_trim(z1, 2 * h + 2);
+    size_t z0n = limbs_trim(r, 2 * h);
+    size_t z2n = limbs_trim(r + 2 * h, a1n + b1n);
+    limbs_sub(z1, z1, z1n, r, z0n);
+    limbs_sub(z1, z1, z1n, r + 2 * h, z2n);
+    z1n = limbs_trim(z1, z1n);
+    limbs_add(r + h, r + h, an + bn - h, z1, z1n);
+
+    free(sa);
+    free(sb);
+    free(z1);
+}
+
+// ---- Number-theoretic transform ----
+
+static uint32_t mul_mod(uint32_t a, uint32_t b, uint32_t p) {
+    return (uint32_t)((uint64_t)a * b % p);
+}
+
+static uint32_t pow_mod(uint32_t b, uint64_t e, uint32_t p) {
+    uint32_t r = 1;
+    while (e) {
+        if (e & 1) r = mul_mod(r, b, p);
+        b = mul_mod(b, b, p);
+        e >>= 1;
+    }
+    return r;
+}
+
+// Montgomery form with R = 2^32; valid for p < 2^31
+static uint32_t mont_neg_inverse(uint32_t p) {
+    uint32_t inv = p;
+    for (int i = 0; i < 4; i++) inv *= 2 - p * inv;
+    return 0u - inv;
+}
+
+static uint32_t mont_mul(uint32_t a, uint32_t b, uint32_t p, uint32_t p_neg_inv) {
+    uint64_t t = (uint64_t)a * b;
+    uint32_t m = (uint32_t)t * p_neg_inv;
+    uint32_t u = (uint32_t)((t + (uint64_t)m * p) >> 32);
+    return u - (p & (0u - (uint32_t)(u >= p)));
+}
+
+// One radix-2 stage (half-length 2^(s-1)) over a[0..len); the stage's
+// twiddles are roots[half..2 half). Decimation in frequency for the forward
+// transform, in time for the inverse, so neither needs a bit reversal.
+static void ntt_stage(uint32_t* a, size_t len, int s, const uint32_t* roots,
+                      uint32_t p, uint32_t p_neg_inv, int dif) {
+    size_t half = (size_t)1 << (s - 1);
+    size_t mask = half - 1;
+    roots += half;
+    #pragma omp taskloop grainsize(NTT_GRAIN) if(len >= 2 * NTT_GRAIN) shared(a, roots)
+    for (size_t t = 0; t < len / 2; t++) {
+        size_t j = t & mask;
+        size_t i = ((t >> (s - 1)) << s) | j;
+        uint32_t w = roots[j];
+        uint32_t u = a[i];
+        uint32_t v = a[i + half];
+        if (!dif) v = mont_mul(v, w, p, p_neg_inv);
+        // Branchless reductions: data-dependent branches mispredict here
+        uint32_t x = u + v;
+        uint32_t y = u - v;
+        y += p & (0u - (uint32_t)(u < v));
+        a[i] = x - (p & (0u - (uint32_t)(x >= p)));
+        a[i + half] = dif ? mont_mul(y, w, p, p_neg_inv) : y;
+    }
+}
+
+// Forward transforms leave the spectrum bit-reversed; the inverse takes it
+// back to natural order. Stages below NTT_BLOCK_LOG run block by block.
+static void ntt_transform(uint32_t* a, size_t n, int log_n, uint32_t p, uint32_t g, int inverse) {
+    uint32_t p_neg_inv = mont_neg_inverse(p);
+    int block_log = log_n < NTT_BLOCK_LOG ? log_n : NTT_BLOCK_LOG;
+    size_t block = (size_t)1 << block_log;
+
+    // roots[h + j] = w^(j n / 2h) (Montgomery form) for the primitive n-th
+    // root w, so every stage reads its twiddles contiguously
+    size_t half_n = n / 2;
+    uint32_t* roots = radix_alloc(n, sizeof(uint32_t));
+    uint32_t w = pow_mod(g, (p - 1) / n, p);
+    if (inverse) w = pow_mod(w, p - 2, p);
+    uint32_t w_mont = (uint32_t)(((uint64_t)w << 32) % p);
+    roots[half_n] = (uint32_t)(((uint64_t)1 << 32) % p);
+    for (size_t j = 1; j < half_n; j++) {
+        roots[half_n + j] = mont_mul(roots[half_n + j - 1], w_mont, p, p_neg_inv);
+    }
+    for (size_t h = half_n / 2; h > 0; h /= 2) {
+        for (size_t j = 0; j < h; j++) roots[h + j] = roots[2 * h + 2 * j];
+    }
+
+    if (!inverse) {
+        for (int s = log_n; s > block_log; s--) {
+            ntt_stage(a, n, s, roots, p, p_neg_inv, 1);
+        }
+    }
+    #pragma omp taskloop if(n > block) shared(a, roots)
+    for (size_t off = 0; off < n; off += block) {
+        for (int k = 1; k <= block_log; k++) {
+            int s = inverse ? k : block_log + 1 - k;
+            ntt_stage(a + off, block, s, roots, p, p_neg_inv, !inverse);
+        }
+    }
+    if (inverse) {
+        for (int s = block_log + 1; s <= log_n; s++) {
+            ntt_stage(a, n, s, roots, p, p_neg_inv, 0);
+        }
+    }
+    free(roots);
+}
+
+// Cyclic convolution of the 16-bit pieces of a and b modulo p
+static uint32_t* ntt_convolve(const uint32_t* a, size_t an, const uint32_t* b, size_t bn,
+                              size_t n, int log_n, uint32_t p, uint32_t g) {
+    uint32_t p_neg_inv = mont_neg_inverse(p);
+    int square = (a == b && an == bn);
+    uint32_t* fa = radix_alloc(n, sizeof(uint32_t));
+    uint32_t* fb = square ? fa : radix_alloc(n, sizeof(uint32_t));
+    for (size_t i = 0; i < an; i++) {
+        fa[2 * i] = a[i] & 0xFFFFu;
+        fa[2 * i + 1] = a[i] >> 16;
+    }
+    if (!square) {
+        for (size_t i = 0; i < bn; i++) {
+            fb[2 * i] = b[i] & 0xFFFFu;
+            fb[2 * i + 1] = b[i] >> 16;
+        }
+    }
+
+    ntt_transform(fa, n, log_n, p, g, 0);
+    if (!square) ntt_transform(fb, n, log_n, p, g, 0);
+    for (size_t i = 0; i < n; i++) fa[i] = mont_mul(fa[i], fb[i], p, p_neg_inv);
+    ntt_transform(fa, n, log_n, p, g, 1);
+
+    // The pointwise product left a factor 1/R: scale by R^2 / n
+    uint32_t r_mod = (uint32_t)(((uint64_t)1 << 32) % p);
+    uint32_t scale = mul_mod(mul_mod(r_mod, r_mod, p), pow_mod((uint32_t)(n % p), p - 2, p), p);
+    for (size_t i = 0; i < n; i++) fa[i] = mont_mul(fa[i], scale, p, p_neg_inv);
+
+    if (!square) free(fb);
+    return fa;
+}
+
+static void mul_ntt(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn, int log_n) {
+    size_t n = (size_t)1 << log_n;
+    uint32_t* c1;
+    uint32_t* c2;
+
+    #pragma omp task shared(c1, a, b)
+    c1 = ntt_convolve(a, an, b, bn, n, log_n, NTT_P1, NTT_G1);
+    c2 = ntt_convolve(a, an, b, bn, n, log_n, NTT_P2, NTT_G2);
+    #pragma omp taskwait
+
+    // CRT: c = c1 + p1 * ((c2 - c1) / p1 mod p2), exact since c < p1 * p2
+    uint32_t p1_inv = pow_mod(NTT_P1 % NTT_P2, NTT_P2 - 2, NTT_P2);
+    size_t pieces = 2 * (an + bn);
+    uint64_t carry = 0;
+    memset(r, 0, (an + bn) * sizeof(uint32_t));
+    for (size_t k = 0; k < pieces; k++) {
+        uint64_t c = 0;
+        if (k < n) {
+            uint32_t x1 = c1[k];
+            uint32_t d = c2[k] + NTT_P2 - x1 % NTT_P2;
+            if (d >= NTT_P2) d -= NTT_P2;
+            c = x1 + (uint64_t)NTT_P1 * mul_mod(d, p1_inv, NTT_P2);
+        }
+        carry += c;
+        r[k / 2] |= (uint32_t)(carry & 0xFFFFu) << (16 * (k & 1));
+        carry >>= 16;
+    }
+
+    free(c1);
+    free(c2);
+}
+
+// r[0..an+bn) = a * b
+static void mul_limbs(uint32_t* r, const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+    if (an < bn) {
+        const uint32_t* t = a;
+        size_t tn = an;
+        a = b; an = bn;
+        b = t; bn = tn;
+    }
+    if (bn == 0) {
+        memset(r, 0, an * sizeof(uint32_t));
+        return;
+    }
+    if (bn < KARATSUBA_THRESHOLD) {
+        mul_schoolbook(r, a, an, b, bn);
+        return;
+    }
+
+    int log_n = 0;
+    while (((size_t)1 << log_n) < 2 * (an + bn)) log_n++;
+    if (bn >= NTT_THRESHOLD && log_n <= NTT_MAX_LOG) {
+        mul_ntt(r, a, an, b, bn, log_n);
+        return;
+    }
+
+    if (bn <= (an + 1) / 2) {
+        // Unbalanced: multiply bn-sized slices of a and accumulate
+        uint32_t* t = radix_alloc(2 * bn, sizeof(uint32_t));
+        memset(r, 0, (an + bn) * sizeof(uint32_t));
+        for (size_t i = 0; i < an; i += bn) {
+            size_t cn = an - i < bn ? an - i : bn;
+            mul_limbs(t, a + i, cn, b, bn);
+            limbs_add(r + i, r + i, an + bn - i, t, cn + bn);
+        }
+        free(t);
+        return;
+    }
+    mul_karatsuba(r, a, an, b, bn);
+}
+
+// ---- RadixNum helpers ----
+
+static RadixNum num_new(size_t len) {
+    RadixNum x;
+    x.limbs = radix_alloc(len, sizeof(uint32_t));
+    x.len = len;
+    return x;
+}
+
+static RadixNum num_from_u64(uint64_t v) {
+    RadixNum x = num_new(2);
+    x.limbs[0] = (uint32_t)v;
+    x.limbs[1] = (uint32_t)(v >> 32);
+    x.len = limbs_trim(x.limbs, 2);
+    return x;
+}
+
+static void num_free(RadixNum* x) {
+    free(x->limbs);
+    x->limbs = NULL;
+    x->len = 0;
+}
+
+static RadixNum num_mul(const RadixNum* a, const RadixNum* b) {
+    RadixNum r = num_new(a->len + b->len);
+    mul_limbs(r.limbs, a->limbs, a->len, b->limbs, b->len);
+    r.len = limbs_trim(r.limbs, r.len);
+    return r;
+}
+
+static size_t num_bit_length(const RadixNum* x) {
+    if (x->len == 0) return 0;
+    uint32_t top = x->limbs[x->len - 1];
+    size_t bits = 0;
+    while (top) {
+        bits++;
+        top >>= 1;
+    }
+    return (x->len - 1) * 32 + bits;
+}
+
+static RadixNum num_shift_right(const RadixNum* x, size_t bits) {
+    size_t skip = bits / 32;
+    unsigned s = (unsigned)(bits % 32);
+    if (skip >= x->len) return num_new(0);
+    RadixNum r = num_new(x->len - skip);
+    for (size_t i = 0; i < r.len; i++) {
+        uint64_t w = x->limbs[i + skip];
+        if (i + skip + 1 < x->len) w |= (uint64_t)x->limbs[i + skip + 1] << 32;
+        r.limbs[i] = (uint32_t)(w >> s);
+    }
+    r.len = limbs_trim(r.limbs, r.len);
+    return r;
+}
+
+static RadixNum num_pow2(size_t bits) {
+    RadixNum r = num_new(bits / 32 + 1);
+    r.limbs[bits / 32] = 1u << (bits % 32);
+    return r;
+}
+
+// x -= y, requires x >= y
+static void num_sub_in_place(RadixNum* x, const RadixNum* y) {
+    limbs_sub(x->limbs, x->limbs, x->len, y->limbs, y->len);
+    x->len = limbs_trim(x->limbs, x->len);
+}
+
+// x += 1, growing by one limb when needed
+static void num_increment(RadixNum* x) {
+    for (size_t i = 0; i < x->len; i++) {
+        if (++x->limbs[i] != 0) return;
+    }
+    uint32_t* grown = radix_alloc(x->len + 1, sizeof(uint32_t));
+    grown[x->len] = 1;
+    free(x->limbs);
+    x->limbs = grown;
+    x->len++;
+}
+
+// ---- Power table ----
+
+// R = floor(2^shift / P), refined by one Newton step from the previous
+// level since 1/P_i ~ (1/P_{i-1})^2, then corrected to the exact floor.
+static void level_reciprocal(RadixLevel* level, const RadixLevel* prev) {
+    const RadixNum* p = &level->power;
+    level->shift = 2 * num_bit_length(p);
+
+    if (!prev) {
+        level->reciprocal = num_from_u64(((uint64_t)1 << level->shift) / p->limbs[0]);
+        return;
+    }
+
+    RadixNum sq = num_mul(&prev->reciprocal, &prev->reciprocal);
+    RadixNum g = num_shift_right(&sq, 2 * prev->shift - level->shift);
+    num_free(&sq);
+
+    // Newton from below: g += g * (2^shift - P g) / 2^shift. The residual
+    // e is about half as wide as g, so the low bits of g cannot reach delta.
+    RadixNum e = num_pow2(level->shift);
+    RadixNum pg = num_mul(p, &g);
+    num_sub_in_place(&e, &pg);
+    num_free(&pg);
+    size_t drop = num_bit_length(&e) + 2 < level->shift ? level->shift - num_bit_length(&e) - 2 : 0;
+    RadixNum g_top = num_shift_right(&g, drop);
+    RadixNum ge = num_mul(&g_top, &e);
+    RadixNum delta = num_shift_right(&ge, level->shift - drop);
+    num_free(&g_top);
+    num_free(&ge);
+    num_free(&e);
+
+    RadixNum r = num_new(g.len > delta.len ? g.len + 1 : delta.len + 1);
+    memcpy(r.limbs, g.limbs, g.len * sizeof(uint32_t));
+    limbs_add(r.limbs, r.limbs, r.len, delta.limbs, delta.len);
+    r.len = limbs_trim(r.limbs, r.len);
+    num_free(&g);
+    num_free(&delta);
+
+    // Remaining error is a few units: walk up while P (R + 1) <= 2^shift
+    RadixNum err = num_pow2(level->shift);
+    RadixNum pr = num_mul(p, &r);
+    num_sub_in_place(&err, &pr);
+    num_free(&pr);
+    while (limbs_cmp(err.limbs, err.len, p->limbs, p->len) >= 0) {
+        num_sub_in_place(&err, p);
+        num_increment(&r);
+    }
+    num_free(&err);
+    level->reciprocal = r;
+}
+
+// Build P_i = 10^(LEAF_DIGITS * 2^i) for LEAF_DIGITS * 2^i <= max_digits
+static RadixLevel* build_levels(long max_digits, int* level_count) {
+    int count = 1;
+    while ((long)LEAF_DIGITS << count <= max_digits) count++;
+
+    RadixLevel* levels = radix_alloc(count, sizeof(RadixLevel));
+    levels[0].power = num_from_u64(LEAF_POWER);
+    for (int i = 1; i < count; i++) {
+        levels[i].power = num_mul(&levels[i - 1].power, &levels[i - 1].power);
+    }
+    // Reciprocals only for levels the conversion tree splits at
+    for (int i = 0; i < count && ((long)LEAF_DIGITS << i) < max_digits; i++) {
+        level_reciprocal(&levels[i], i > 0 ? &levels[i - 1] : NULL);
+    }
+
+    *level_count = count;
+    return levels;
+}
+
+static void free_levels(RadixLevel* levels, int count) {
+    for (int i = 0; i < count; i++) {
+        num_free(&levels[i].power);
+        num_free(&levels[i].reciprocal);
+    }
+    free(levels);
+}
+
+// ---- Conversion tree ----
+
+// Barrett division by P_i; valid for a < P_i^2. With b = bitlen(P_i),
+// ((a >> (b - 1)) R) >> (b + 1) undershoots the quotient by at most 2.
+static void divmod_level(const RadixNum* a, const RadixLevel* level, RadixNum* q, RadixNum* r) {
+    size_t b = level->shift / 2;
+    RadixNum top = num_shift_right(a, b - 1);
+    RadixNum t = num_mul(&top, &level->reciprocal);
+    *q = num_shift_right(&t, b + 1);
+    num_free(&top);
+    num_free(&t);
+
+    RadixNum qp = num_mul(q, &level->power);
+    *r = num_new(a->len);
+    memcpy(r->limbs, a->limbs, a->len * sizeof(uint32_t));
+    num_sub_in_place(r, &qp);
+    num_free(&qp);
+
+    while (limbs_cmp(r->limbs, r->len, level->power.limbs, level->power.len) >= 0) {
+        num_sub_in_place(r, &level->power);
+        num_increment(q);
+    }
+}
+
+static void convert_basecase(const RadixNum* a, long m, char* out) {
+    uint32_t* x = radix_alloc(a->len, sizeof(uint32_t));
+    size_t n = a->len;
+    long pos = m;
+    memcpy(x, a->limbs, n * sizeof(uint32_t));
+
+    while (pos > 0) {
+        uint64_t rem = 0;
+        for (size_t i = n; i-- > 0;) {
+            uint64_t cur = (rem << 32) | x[i];
+            x[i] = (uint32_t)(cur / LEAF_POWER);
+            rem = cur % LEAF_POWER;
+        }
+        n = limbs_trim(x, n);
+        for (int d = 0; d < LEAF_DIGITS && pos > 0; d++) {
+            out[--pos] = (char)('0' + rem % 10);
+            rem /= 10;
+        }
+    }
+    free(x);
+}
+
+// Write a (< 10^m) as exactly m zero-padded decimal digits
+static void convert_block(const RadixNum* a, long m, char* out, const RadixLevel* levels) {
+    if (m <= BASECASE_DIGITS) {
+        convert_basecase(a, m, out);
+        return;
+    }
+
+    int i = 0;
+    while (((long)LEAF_DIGITS << (i + 1)) < m) i++;
+    long low_digits = (long)LEAF_DIGITS << i;
+
+    RadixNum hi, lo;
+    divmod_level(a, &levels[i], &hi, &lo);
+
+    #pragma omp task shared(hi, out, levels) if(m >= TASK_MIN_DIGITS)
+    convert_block(&hi, m - low_digits, out, levels);
+    convert_block(&lo, low_digits, out + (m - low_digits), levels);
+    #pragma omp taskwait
+
+    num_free(&hi);
+    num_free(&lo);
+}
+
+// Trailing run of '9' in digits[0..count)
+static long trailing_nines(const char* digits, long count) {
+    long run = 0;
+    while (run < count && digits[count - 1 - run] == '9') run++;
+    return run;
+}
+
+// Constructor
+RadixConversion* radix_convert_hex_to_decimal(const int* hex_digits, long hex_count) {
+    if (hex_count < 0) return NULL;
+    for (long i = 0; i < hex_count; i++) {
+        if (hex_digits[i] < 0 || hex_digits[i] > 15) return NULL;
+    }
+
+    RadixConversion* conversion = malloc(sizeof(RadixConversion));
+    if (!conversion) return NULL;
+
+    // 10^M <= 16^N keeps floor((H + 1) 10^M / 16^N) within one of the result
+    long m = (long)floor((double)hex_count * LOG10_16 - 1e-9);
+    if (m < 0) m = 0;
+    conversion->digits = malloc((size_t)m + 1);
+    if (!conversion->digits) {
+        free(conversion);
+        return NULL;
+    }
+    conversion->digits[m] = '\0';
+    conversion->digit_count = m;
+    conversion->valid_count = m;
+#ifdef _OPENMP
+    conversion->threads = omp_get_max_threads();
+#else
+    conversion->threads = 1;
+#endif
+    if (m == 0) return conversion;
+
+    // H = the hex digits as an integer, packed eight nibbles per limb
+    size_t frac_bits = 4 * (size_t)hex_count;
+    RadixNum h = num_new((size_t)(hex_count + 7) / 8);
+    for (long k = 0; k < hex_count; k++) {
+        h.limbs[k / 8] |= (uint32_t)hex_digits[hex_count - 1 - k] << (4 * (k % 8));
+    }
+    h.len = limbs_trim(h.limbs, h.len);
+
+    #pragma omp parallel
+    #pragma omp single
+    {
+        int level_count;
+        RadixLevel* levels = build_levels(m, &level_count);
+
+        // 10^M from the power table bits of M / LEAF_DIGITS
+        RadixNum scale = num_from_u64(1);
+        for (long r = m % LEAF_DIGITS; r > 0; r--) {
+            RadixNum ten = num_from_u64(10);
+            RadixNum t = num_mul(&scale, &ten);
+            num_free(&scale);
+            num_free(&ten);
+            scale = t;
+        }
+        for (int i = 0; i < level_count; i++) {
+            if (((m / LEAF_DIGITS) >> i) & 1) {
+                RadixNum t = num_mul(&scale, &levels[i].power);
+                num_free(&scale);
+                scale = t;
+            }
+        }
+
+        // D = floor(H 10^M / 2^(4N)); D + 1 is the upper bound when the
+        // discarded low bits plus 10^M carry past 2^(4N)
+        RadixNum x = num_mul(&h, &scale);
+        RadixNum d = num_shift_right(&x, frac_bits);
+
+        size_t low_len = frac_bits / 32 + 1;
+        RadixNum low = num_new((scale.len > low_len ? scale.len : low_len) + 1);
+        memcpy(low.limbs, x.limbs, (x.len < low_len ? x.len : low_len) * sizeof(uint32_t));
+        if (frac_bits % 32) low.limbs[frac_bits / 32] &= (1u << (frac_bits % 32)) - 1;
+        else low.limbs[frac_bits / 32] = 0;
+        limbs_add(low.limbs, low.limbs, low.len, scale.limbs, scale.len);
+        low.len = limbs_trim(low.limbs, low.len);
+        int upper_differs = num_bit_length(&low) > frac_bits;
+        num_free(&low);
+        num_free(&x);
+        num_free(&scale);
+
+        convert_block(&d, m, conversion->digits, levels);
+        num_free(&d);
+        free_levels(levels, level_count);
+
+        if (upper_differs) {
+            long valid = m - 1 - trailing_nines(conversion->digits, m);
+            conversion->valid_count = valid > 0 ? valid : 0;
+        }
+    }
+
+    num_free(&h);
+    return conversion;
+}
+
+// Destructor
+void radix_conversion_destroy(RadixConversion* conversion) {
+    if (conversion) {
+        free(conversion->digits);
+        free(conversion);
+    }
+}